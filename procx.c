@@ -17,13 +17,22 @@
 #include <pthread.h>
 #include <sys/errno.h>
 #include <sys/msg.h>
+#include <sys/wait.h>   // waitpid, WIFEXITED, WEXITSTATUS
 
-#define SHM_NAME "/procx_shm_v7"
-#define SEM_NAME "/procx_sem_v7"
-#define MQ_NAME "procx_mq_v7"
+#define SHM_NAME "/procx_shm_v8"
+#define SEM_NAME "/procx_sem_v8"
+#define MQ_NAME "procx_mq_v8"
 #define MAX_PROCESSES 50
 #define MAX_TERMINALS 3
 
+// Restart supervision ayarları
+#define RESTART_BUCKET_CAPACITY 3.0 // Token bucket kapasitesi (art arda yapılabilecek restart)
+#define RESTART_REFILL_SECONDS 20   // Her token bu kadar saniyede bir dolar
+#define RESTART_BACKOFF_BASE 1      // İlk bekleme süresi (saniye)
+#define RESTART_BACKOFF_MAX 60      // Bekleme süresi üst sınırı (saniye)
+#define CRASH_LOOP_UPTIME 10        // Bundan kısa yaşayan process hızlı çöküş sayılır
+#define CRASH_LOOP_THRESHOLD 5      // Art arda bu kadar hızlı çöküş = karantina
+
 // Process bilgisi
 typedef enum {
     ATTACHED = 0,
@@ -32,9 +41,18 @@ typedef enum {
 
 typedef enum {
     RUNNING = 0,
-    TERMINATED = 1
+    TERMINATED = 1,
+    RESTARTING = 2, // Backoff süresinin dolması bekleniyor
+    QUARANTINED = 3, // Crash-loop tespit edildi, tekrar başlatılmaz
+    SPAWNING = 4 // Monitor kilit dışında fork ediyor, pid henüz yazılmadı
 } ProcessStatus;
 
+typedef enum {
+    RESTART_NEVER = 0,
+    RESTART_ON_FAILURE = 1,
+    RESTART_ALWAYS = 2
+} RestartPolicy;
+
 typedef struct {
     pid_t pid; // Process ID
     pid_t owner_pid; // Başlatan instance'ın PID'si
@@ -43,6 +61,14 @@ typedef struct {
     ProcessStatus status; // Running (0) veya Terminated (1)
     time_t start_time; // Başlangıç zamanı
     int is_active; // Aktif mi? (1: Evet, 0: Hayır)
+    RestartPolicy restart_policy; // Never (0), On-failure (1) veya Always (2)
+    int restart_count; // Toplam restart sayısı
+    int fast_failures; // Art arda hızlı çöküş sayısı
+    int stop_requested; // Kullanıcı sonlandırdıysa restart edilmez
+    char last_exit[32]; // Son çıkış nedeni ("exit 1", "signal 11")
+    double restart_tokens; // Token bucket'taki token sayısı
+    time_t tokens_updated; // Token'ların son doldurulma zamanı
+    time_t next_restart_time; // RESTARTING durumunda restart zamanı
 } ProcessInfo;
 
 // Paylaşılan bellek yapısı
@@ -56,7 +82,7 @@ typedef struct {
 // Mesaj yapısı
 typedef struct {
     long msg_type; // Mesaj tipi
-    int command; // Komut (START/TERMINATE)
+    int command; // Komut (1: START, 2: TERMINATE, 3: RESTART, 4: QUARANTINE)
     pid_t sender_pid; // Gönderen PID
     pid_t target_pid; // Hedef process PID
 } Message;
@@ -84,21 +110,114 @@ int is_numeric(const char* str) { // input numerik mi?
 int parse_command(char* line, char** argv, int max_args) { // gelen komutu execvp için uygun formatta parçala
     int argc = 0;
     char* token;
+    char* save_ptr; // monitor thread de restart için parse ettiğinden strtok_r
     // newline varsa sil
     line[strcspn(line, "\n")] = '\0';
-    token = strtok(line, " ");
+    token = strtok_r(line, " ", &save_ptr);
     while (token != NULL && argc < max_args) {
         if (strcmp(token, "&") == 0) {
-            token = strtok(NULL, " ");
+            token = strtok_r(NULL, " ", &save_ptr);
             continue;
         }
         argv[argc++] = token;
-        token = strtok(NULL, " ");
+        token = strtok_r(NULL, " ", &save_ptr);
     }
     argv[argc] = NULL; // Son karakter null olmalı
     return argc;
 }
 
+pid_t spawn_process(const char* command, ProcessMode mode) { // komutu fork + exec ile çalıştır
+    char* argv[20];
+    char temp_command[256]; // parse_command stringi değiştirdiği için kopya
+
+    strncpy(temp_command, command, 255);
+    temp_command[255] = '\0';
+    int argument_count = parse_command(temp_command, argv, 19); // argv[19] NULL için ayrıldı
+    if (argument_count == 0) {
+        printf("Komut bulunamadı!");
+        return -1;
+    }
+    // Bufferdaki çıktı child'a kopyalanıp tekrar basılmasın. fflush(NULL) değil: main thread
+    // fgets içinde stdin kilidini tutarken monitor thread kilitlenirdi
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("Fork failed");
+        return -1;
+    }
+    else if (pid == 0) { // child
+        if (mode == DETACHED) {
+            setsid();
+        }
+        execvp(argv[0], argv);
+        perror("Execvp hatası!");
+        _exit(127); // exit() parent'tan kopyalanan stdio bufferlarını flush eder
+    }
+    return pid;
+}
+
+const char* policy_name(RestartPolicy policy) {
+    switch (policy) {
+    case RESTART_ON_FAILURE: return "OnFail";
+    case RESTART_ALWAYS: return "Always";
+    default: return "Never";
+    }
+}
+
+const char* status_name(ProcessStatus status) {
+    switch (status) {
+    case RUNNING: return "Running";
+    case RESTARTING: return "Restart";
+    case QUARANTINED: return "Karantina";
+    case SPAWNING: return "Spawning";
+    default: return "Bitti";
+    }
+}
+
+void record_exit_status(ProcessInfo* process, int status) { // waitpid sonucunu tabloya yaz
+    if (WIFEXITED(status)) {
+        snprintf(process->last_exit, sizeof(process->last_exit), "exit %d", WEXITSTATUS(status));
+    }
+    else if (WIFSIGNALED(status)) {
+        snprintf(process->last_exit, sizeof(process->last_exit), "signal %d", WTERMSIG(status));
+    }
+}
+
+void refill_restart_tokens(ProcessInfo* process, time_t now) { // token bucket'ı geçen süre kadar doldur
+    double elapsed = difftime(now, process->tokens_updated);
+    if (elapsed <= 0) return;
+
+    process->restart_tokens += elapsed / RESTART_REFILL_SECONDS;
+    if (process->restart_tokens > RESTART_BUCKET_CAPACITY) {
+        process->restart_tokens = RESTART_BUCKET_CAPACITY;
+    }
+    process->tokens_updated = now;
+}
+
+void release_slot(ProcessInfo* process) { // sem kilitliyken çağrılır, slotu boşaltır
+    if (!process->is_active) return; // Zaten boşaltılmışsa sayaç iki kez düşmesin
+    process->is_active = 0;
+    process->status = TERMINATED;
+    shared_memory->process_count--;
+}
+
+int token_wait_seconds(const ProcessInfo* process) { // bir token dolana kadar kalan süre
+    if (process->restart_tokens >= 1.0) return 0;
+    return (int)((1.0 - process->restart_tokens) * RESTART_REFILL_SECONDS) + 1;
+}
+
+int restart_backoff(int failures) { // jitterlı üstel bekleme: [delay/2, delay] arası rastgele
+    int delay = RESTART_BACKOFF_BASE;
+    for (int i = 0; i < failures && delay < RESTART_BACKOFF_MAX; i++) {
+        delay *= 2;
+    }
+    if (delay > RESTART_BACKOFF_MAX) delay = RESTART_BACKOFF_MAX;
+
+    // Aynı anda çöken processler aynı saniyede tekrar başlamasın
+    return delay / 2 + rand() % (delay - delay / 2 + 1);
+}
+
 void init_shared_memory() { // shared memory'i başlat
     // Shared Memory
     int shm_fd = shm_open(SHM_NAME, O_RDWR, 0666);
@@ -245,36 +364,44 @@ void list_processes() { // mevcut processleri listele
     sem_wait(procx_sem);
 
     int count = 0;
+    int running_count = 0; // Restart bekleyen / karantinadakiler hariç
     time_t now = time(NULL);
 
     printf("\n%35s\n", "ÇALIŞAN PROGRAMLAR");
-    printf("----------------------------------------------------------------------\n");
-    printf("%-8s | %-25s | %-10s | %-8s | %s\n",
-           "PID", "Command", "Mode", "Owner", "Süre");
-    printf("----------------------------------------------------------------------\n");
+    printf("------------------------------------------------------------------------------------------------------\n");
+    printf("%-8s | %-20s | %-8s | %-8s | %-9s | %-6s | %-3s | %-10s | %s\n",
+           "PID", "Command", "Mode", "Owner", "Status", "Policy", "Rst", "Last Exit", "Süre");
+    printf("------------------------------------------------------------------------------------------------------\n");
 
     for (int i = 0; i < MAX_PROCESSES; i++) {
         if (shared_memory->processes[i].is_active) {
             long elapsed_seconds = now - shared_memory->processes[i].start_time;
             char* mode_str = (shared_memory->processes[i].mode == DETACHED) ? "Detached" : "Attached";
 
-            printf("%-8d | %-25s | %-10s | %-8d | %ld%s\n",
+            printf("%-8d | %-20.20s | %-8s | %-8d | %-9s | %-6s | %-3d | %-10s | %ld%s\n",
                    shared_memory->processes[i].pid, // PID
                    shared_memory->processes[i].command, // Command
                    mode_str, // Mode (Attached/Detached)
                    shared_memory->processes[i].owner_pid, // Owner
+                   status_name(shared_memory->processes[i].status), // Running/Restart/Karantina
+                   policy_name(shared_memory->processes[i].restart_policy), // Restart politikası
+                   shared_memory->processes[i].restart_count, // Restart sayısı
+                   shared_memory->processes[i].last_exit[0] ? shared_memory->processes[i].last_exit : "-",
                    elapsed_seconds, // Süre (sayı)
                    "s" // Sürenin sonuna 's' harfi
             );
             count++;
+            if (shared_memory->processes[i].status == RUNNING) {
+                running_count++;
+            }
         }
     }
     if (count == 0) {
         printf("Aktif çalışan process bulunamadı.\n");
     }
 
-    printf("----------------------------------------------------------------------\n");
-    printf("Toplam: %d process çalışıyor.\n\n", count);
+    printf("------------------------------------------------------------------------------------------------------\n");
+    printf("Toplam: %d kayıt, %d process çalışıyor.\n\n", count, running_count);
 
     sem_post(procx_sem);
 }
@@ -318,31 +445,14 @@ int get_menu() {
     }
 }
 
-void start_process(char* command, ProcessMode mode) {
-    char* argv[20];
-    char temp_command[256]; // orjinal command shared memorye yazmak için kopyalandı
+void start_process(char* command, ProcessMode mode, RestartPolicy policy) {
+    int status;
 
     command[strcspn(command, "\n")] = '\0';
-    strncpy(temp_command, command, 255);
-    int argument_count = parse_command(temp_command, argv, 20);
-    int status;
-    if (argument_count == 0) {
-        printf("Komut bulunamadı!");
-        return;
-    }
-    pid_t pid = fork();
+    pid_t pid = spawn_process(command, mode);
     if (pid < 0) {
-        perror("Fork failed");
         return;
     }
-    else if (pid == 0) { // child
-        if (mode == DETACHED) {
-            setsid();
-        }
-        execvp(argv[0], argv);
-        perror("Execvp hatası!");
-        exit(1);
-    }
     else { // parent
         printf("\n[SUCCESS] Process başlatıldı: PID: %d\n", pid);
         sem_wait(procx_sem);
@@ -361,13 +471,17 @@ void start_process(char* command, ProcessMode mode) {
             sem_post(procx_sem);
             return;
         }
+        memset(&shared_memory->processes[index], 0, sizeof(ProcessInfo)); // Önceki kaydın restart bilgilerini sil
         shared_memory->processes[index].pid = pid;
         shared_memory->processes[index].owner_pid = getpid();
-        strcpy(shared_memory->processes[index].command, command);
+        strncpy(shared_memory->processes[index].command, command, 255);
         shared_memory->processes[index].is_active = 1;
         shared_memory->processes[index].mode = mode;
         shared_memory->processes[index].start_time = time(NULL);
         shared_memory->processes[index].status = RUNNING;
+        shared_memory->processes[index].restart_policy = policy;
+        shared_memory->processes[index].restart_tokens = RESTART_BUCKET_CAPACITY;
+        shared_memory->processes[index].tokens_updated = time(NULL);
         shared_memory->process_count++;
 
 
@@ -376,11 +490,15 @@ void start_process(char* command, ProcessMode mode) {
         send_message(1, pid);
 
         if (mode == ATTACHED) {
-            waitpid(pid, &status, 0);
+            pid_t reaped = waitpid(pid, &status, 0);
             sem_wait(procx_sem);
-            shared_memory->processes[index].status = TERMINATED;
-            shared_memory->processes[index].is_active = 0;
-            shared_memory->process_count--;
+            // Monitor thread daha önce temizlemiş olabilir
+            if (shared_memory->processes[index].is_active && shared_memory->processes[index].pid == pid) {
+                if (reaped == pid) {
+                    record_exit_status(&shared_memory->processes[index], status);
+                }
+                release_slot(&shared_memory->processes[index]);
+            }
             sem_post(procx_sem);
             printf("\n[INFO] Attached process sonlandı: PID: %d\n", pid);
             send_message(2, pid);
@@ -391,7 +509,9 @@ void start_process(char* command, ProcessMode mode) {
 void get_process_menu() {
     char komut[64];
     char mode[10];
+    char policy[10];
     ProcessMode process_mode;
+    RestartPolicy restart_policy = RESTART_NEVER;
 
     while (true) {
         printf("Çalıştırılacak komutu giriniz: ");
@@ -404,7 +524,16 @@ void get_process_menu() {
                 continue;
             }
             process_mode = (ProcessMode)atoi(mode);
-            start_process(komut, process_mode);
+            if (process_mode == DETACHED) { // Attached process menüyü bloklar, sadece detached restart edilir
+                printf("Restart Politikası (0: Never, 1: On-failure, 2: Always): ");
+                if (fgets(policy, sizeof(policy), stdin) == NULL) continue;
+                if (policy[0] < '0' || policy[0] > '2') {
+                    printf("Lütfen menüden geçerli bir seçenek (0-2) girin!\n");
+                    continue;
+                }
+                restart_policy = (RestartPolicy)atoi(policy);
+            }
+            start_process(komut, process_mode, restart_policy);
             break;
         }
     }
@@ -417,9 +546,25 @@ void stop_process(int target_pid) {
     for (int i = 0; i < MAX_PROCESSES; i++) {
         if (shared_memory->processes[i].is_active) {
             if (shared_memory->processes[i].pid == target_pid) {
+                found = 1;
+                if (shared_memory->processes[i].status == SPAWNING) {
+                    // Monitor şu an fork ediyor: pid yazılınca yeni process sonlandırılacak
+                    shared_memory->processes[i].stop_requested = 1;
+                    sem_post(procx_sem);
+                    printf("[INFO] Process %d yeniden başlatılıyor, başlar başlamaz sonlandırılacak.\n", target_pid);
+                    break;
+                }
+                if (shared_memory->processes[i].status != RUNNING) {
+                    // Restart bekleyen / karantinadaki kayıt: çalışan process yok, sadece listeden düş
+                    release_slot(&shared_memory->processes[i]);
+                    sem_post(procx_sem);
+                    printf("[INFO] Process %d kaydı listeden kaldırıldı.\n", target_pid);
+                    send_message(2, target_pid);
+                    break;
+                }
+                shared_memory->processes[i].stop_requested = 1; // Monitor restart etmesin
                 kill(target_pid, SIGTERM);
                 printf("[INFO] Process %d öldürüldü.\n", target_pid);
-                found = 1;
                 sem_post(procx_sem);
                 break;
             }
@@ -509,14 +654,16 @@ void shutdown_system() {
                     // Process'i işletim sistemi seviyesinde öldür
                     kill(shared_memory->processes[i].pid, SIGTERM);
                     // Her durumda Shared Memory listesinden düşüyoruz çünkü ProcX kapanıyor.
-                    shared_memory->processes[i].is_active = 0;
-                    shared_memory->processes[i].status = TERMINATED;
-                    shared_memory->process_count--;
+                    release_slot(&shared_memory->processes[i]);
                     printf("[TEMİZLİK] Kapatılırken attached process sonlandırıldı: %d\n",
                            shared_memory->processes[i].pid);
                 }
+                else if (shared_memory->processes[i].status != RUNNING) {
+                    // Restart bekleyen / karantinadaki kayıt: supervisor kapanıyor, kimse restart etmeyecek
+                    release_slot(&shared_memory->processes[i]);
+                }
                 else { // Detach processler
-                    // Çalışmaya devam eder ama artık procx yönetiminde olmaz??
+                    // Çalışmaya devam eder ama artık procx yönetiminde olmaz (restart edilmez)
                     printf("[INFO] Detached process arka planda bırakıldı: %d\n", shared_memory->processes[i].pid);
                     shared_memory->processes[i].owner_pid = -1; // artık sahibi ben değilim
                 }
@@ -537,6 +684,135 @@ void handle_sigint(int sig) {
     exit_requested = 1;
 }
 
+int is_owner_alive(pid_t owner_pid) { // sahip terminal hala çalışıyor mu?
+    return owner_pid > 0 && (kill(owner_pid, 0) == 0 || errno != ESRCH);
+}
+
+int handle_process_exit(int i, pid_t check_pid, int status, int have_status) { // sem kilitliyken çağrılır, gönderilecek mesajı döndürür
+    ProcessInfo* process = &shared_memory->processes[i];
+    time_t now = time(NULL);
+
+    if (have_status) {
+        record_exit_status(process, status);
+    }
+    else { // Sahibi ben değilsem exit status'a erişemem
+        strcpy(process->last_exit, "bilinmiyor");
+    }
+
+    int failed = !have_status || !(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    int restart = have_status && !process->stop_requested &&
+                  (process->restart_policy == RESTART_ALWAYS ||
+                   (process->restart_policy == RESTART_ON_FAILURE && failed));
+
+    if (!restart) {
+        release_slot(process);
+        printf("\n[MONITOR] Process %d temizlendi (Owner: %d, %s).\n", check_pid, process->owner_pid, process->last_exit);
+        return 2;
+    }
+
+    // Crash-loop tespiti: kısa süre yaşayıp tekrar ölen process
+    if (difftime(now, process->start_time) < CRASH_LOOP_UPTIME) {
+        process->fast_failures++;
+    }
+    else {
+        process->fast_failures = 0;
+    }
+
+    if (process->fast_failures >= CRASH_LOOP_THRESHOLD) {
+        process->status = QUARANTINED;
+        printf("\n[MONITOR] Process %d crash-loop'ta (%d hızlı çöküş), karantinaya alındı.\n",
+               check_pid, process->fast_failures);
+        return 4;
+    }
+
+    refill_restart_tokens(process, now);
+    int delay = restart_backoff(process->fast_failures);
+    if (token_wait_seconds(process) > delay) { // Token bucket boşsa token dolana kadar bekle
+        delay = token_wait_seconds(process);
+    }
+    process->next_restart_time = now + delay;
+    process->status = RESTARTING;
+    printf("\n[MONITOR] Process %d sonlandı (%s), %d sn sonra yeniden başlatılacak.\n",
+           check_pid, process->last_exit, delay);
+    return 2;
+}
+
+void restart_pending_processes() { // backoff süresi dolan processleri yeniden başlat
+    pid_t my_pid = getpid();
+
+    for (int i = 0; i < MAX_PROCESSES; i++) {
+        ProcessInfo* process = &shared_memory->processes[i];
+        char command[256];
+        ProcessMode mode;
+        pid_t old_pid = -1;
+        int spawn = 0;
+
+        sem_wait(procx_sem);
+        time_t now = time(NULL);
+        if (process->is_active && process->owner_pid == my_pid &&
+            process->status == RESTARTING && now >= process->next_restart_time) {
+            refill_restart_tokens(process, now);
+            if (process->restart_tokens < 1.0) { // Rate limit: token yoksa ertele
+                process->next_restart_time = now + token_wait_seconds(process);
+            }
+            else {
+                // Slotu SPAWNING işaretle, fork global kilidi tutmadan yapılsın
+                process->restart_tokens -= 1.0;
+                process->status = SPAWNING;
+                strcpy(command, process->command);
+                mode = process->mode;
+                old_pid = process->pid;
+                spawn = 1;
+            }
+        }
+        sem_post(procx_sem);
+
+        if (!spawn) {
+            continue;
+        }
+
+        pid_t new_pid = spawn_process(command, mode);
+        int orphaned = 0;
+        int stopped = 0;
+
+        sem_wait(procx_sem);
+        now = time(NULL);
+        if (!process->is_active || process->status != SPAWNING || process->pid != old_pid) {
+            orphaned = 1; // Fork sırasında slot boşaltıldı (örn. shutdown)
+        }
+        else if (new_pid > 0) {
+            process->pid = new_pid;
+            process->start_time = now;
+            process->status = RUNNING;
+            process->restart_count++;
+            stopped = process->stop_requested; // Fork sırasında stop_process çağrıldı
+        }
+        else { // Fork başarısız, token'ı iade et ve daha sonra tekrar dene
+            process->restart_tokens += 1.0;
+            process->status = RESTARTING;
+            process->next_restart_time = now + restart_backoff(process->fast_failures);
+        }
+        sem_post(procx_sem);
+
+        if (new_pid <= 0) {
+            continue;
+        }
+        if (orphaned) {
+            kill(new_pid, SIGTERM);
+            waitpid(new_pid, NULL, 0); // Tabloda kaydı yok, zombie kalmasın
+        }
+        else if (stopped) {
+            // Monitor bir sonraki turda reap edip stop_requested nedeniyle slotu boşaltır
+            kill(new_pid, SIGTERM);
+            printf("\n[MONITOR] Process %d yeniden başlatılırken durduruldu: PID: %d\n", old_pid, new_pid);
+        }
+        else {
+            printf("\n[MONITOR] Process %d yeniden başlatıldı: PID: %d\n", old_pid, new_pid);
+            send_message(3, new_pid);
+        }
+    }
+}
+
 void* monitor_thread(void* arg) {
     int status;
     while (!exit_requested) {
@@ -544,14 +820,17 @@ void* monitor_thread(void* arg) {
         if (exit_requested) break;
         for (int i = 0; i < MAX_PROCESSES; i++) {
             int found = 0;
+            int have_status = 0;
             pid_t check_pid = -1;
             pid_t owner_pid = -1;
+            ProcessStatus slot_status = TERMINATED;
             int is_active = 0;
             sem_wait(procx_sem);
             if (shared_memory->processes[i].is_active) {
                 is_active = 1;
                 owner_pid = shared_memory->processes[i].owner_pid;
                 check_pid = shared_memory->processes[i].pid;
+                slot_status = shared_memory->processes[i].status;
             }
             sem_post(procx_sem);
 
@@ -559,12 +838,39 @@ void* monitor_thread(void* arg) {
                 continue;
             }
 
+            // Restart bekleyen / karantinadaki kayıtların çalışan processi yok, onları sahibi yönetir.
+            // Sahibi temiz kapanmadan öldüyse (SIGKILL, crash) kayıt sonsuza kadar kalmasın.
+            if (slot_status != RUNNING) {
+                if (owner_pid == getpid() || is_owner_alive(owner_pid)) {
+                    continue;
+                }
+                int cleaned = 0;
+                sem_wait(procx_sem);
+                if (shared_memory->processes[i].is_active && shared_memory->processes[i].pid == check_pid &&
+                    shared_memory->processes[i].status == slot_status) {
+                    release_slot(&shared_memory->processes[i]);
+                    cleaned = 1;
+                    printf("\n[MONITOR] Sahibi kapanan process %d kaydı temizlendi (Owner: %d).\n", check_pid, owner_pid);
+                }
+                sem_post(procx_sem);
+
+                if (cleaned) {
+                    send_message(2, check_pid);
+                }
+                continue;
+            }
+
 
             if (owner_pid == getpid()) { // Çocuğun parentı ben miyim?
                 if (waitpid(check_pid, &status, WNOHANG) == check_pid) { // Çocuk ölmüş mü?
                     found = 1;
+                    have_status = 1;
                 }
             }
+            else if (is_owner_alive(owner_pid)) {
+                // Sahibi hala açık: exit status'u alıp restart kararını o verecek
+                continue;
+            }
             else { // Çocuğun parentı ben değilsem
                 // kill pid yi bulamadı (process ölmüş)
                 if (kill(check_pid, 0) == -1 && errno == ESRCH) {
@@ -572,24 +878,21 @@ void* monitor_thread(void* arg) {
                 }
             }
             if (found) {
-                int cleaned = 0;
+                int message = 0;
                 sem_wait(procx_sem);
                 // Kilidi alana kadar değişiklik oldu mu?
-                if (shared_memory->processes[i].is_active && shared_memory->processes[i].pid == check_pid) {
-                    shared_memory->processes[i].is_active = 0;
-                    shared_memory->processes[i].status = TERMINATED;
-                    shared_memory->process_count--;
-                    cleaned = 1;
-
-                    printf("\n[MONITOR] Process %d temizlendi (Owner: %d).\n", check_pid, owner_pid);
+                if (shared_memory->processes[i].is_active && shared_memory->processes[i].pid == check_pid &&
+                    shared_memory->processes[i].status == RUNNING) {
+                    message = handle_process_exit(i, check_pid, status, have_status);
                 }
                 sem_post(procx_sem);
 
-                if (cleaned) {
-                    send_message(2, check_pid);
+                if (message) {
+                    send_message(message, check_pid);
                 }
             }
         }
+        restart_pending_processes();
     }
     return NULL;
 }
@@ -621,12 +924,19 @@ void* ipc_thread(void* arg) {
         else if (message.command == 2) {
             printf("\n[IPC] Process sonlandı: %d \n", message.target_pid);
         }
+        else if (message.command == 3) {
+            printf("\n[IPC] Process yeniden başlatıldı: %d \n", message.target_pid);
+        }
+        else if (message.command == 4) {
+            printf("\n[IPC] Process crash-loop nedeniyle karantinaya alındı: %d \n", message.target_pid);
+        }
     }
     return NULL;
 }
 
 
 int main(int argc, char* argv[], char** envp) {
+    srand(time(NULL) ^ getpid()); // Restart backoff jitter'ı için
     init_shared_memory();
     init_semaphore();
     init_message_queue();